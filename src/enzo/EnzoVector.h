@@ -159,6 +159,15 @@ class EnzoVector {
   //   Vector axpy operation, this += a*x
   int axpy(float a, EnzoVector *x);
 
+  //   Fused linear combination, this = sum_j c[j]*x[j]  (one pass;
+  //   this may also appear among the x[j])
+  int linearcombination(int n, float *c, EnzoVector **x);
+
+  //   Fused linear sum and dot-product, this = a*x + b*y, followed by
+  //   *result = dot(this,w) (w == NULL -> dot(this,this))
+  int linearsum_dot(float a, EnzoVector *x, float b, EnzoVector *y,
+		    EnzoVector *w, float *result);
+
   //   Vector axpy operation (single component), this += a*x
   int axpy_component(float a, EnzoVector *x, int c);
 
@@ -213,6 +222,18 @@ class EnzoVector {
   //   Vector dot-product,  dot(this,x)
   float dot(EnzoVector *x) const;
 
+  //   Batched dot-products, result[j] = dot(this,x[j]) (one pass, one
+  //   global reduction)
+  int dotprods(int n, EnzoVector **x, float *result) const;
+
+  //   Vector RMS and infinity norms together (one pass, one global
+  //   reduction)
+  int norms(float *rms, float *max) const;
+
+  //   Component RMS and infinity norms of every species together,
+  //   rms[var] and max[var] for var = 0..Nspecies-1 (one global reduction)
+  int norms_component(float *rms, float *max) const;
+
   //   Vector RMS norm,  sqrt(dot(this,this)/Nglobal)
   float rmsnorm() const;
 
@@ -0,0 +1,81 @@
+/***********************************************************************
+/
+/  Built-in Multigrid Solver Class for the FLD radiation system
+/
+/  written by: Enzo development team
+/  date:       October, 2026
+/  modified1:
+/
+/  PURPOSE: Matrix-free alternative to the HYPRE struct solvers for
+/  the 3-, 5- or 7-point stencil systems built by the split FLD
+/  module (gFLDSplit::SetupSystem).  The outer Krylov iteration (PCG
+/  or BiCGStab) works on the root-grid decomposition, exchanging halos
+/  through EnzoVector.  It is preconditioned by a geometric multigrid
+/  V-cycle on each processor's block: coarse operators are Galerkin
+/  aggregates of the fine stencil, and inside the preconditioner only,
+/  couplings across processor faces are lumped into the diagonal.  The level
+/  hierarchy and all work vectors are allocated once, in the
+/  constructor; Setup only refreshes the stencil coefficients.
+/
+************************************************************************/
+
+#ifndef FLD_MULTIGRID_DEFINED__
+#define FLD_MULTIGRID_DEFINED__
+
+#define FLD_MG_MAX_LEVELS 16
+
+class EnzoVector;
+
+class FLDMultigrid {
+
+ private:
+
+  int rank;          // problem dimension
+  int rlxtype;       // smoother (same meaning as RadHydroMGRelaxType)
+  int npre;          // num. pre-relaxation sweeps
+  int npost;         // num. post-relaxation sweeps
+
+  // operators hold 7 entries per cell, ordered as the HYPRE stencil:
+  // z-left, y-left, x-left, self, x-right, y-right, z-right
+  float *FineA;      // full fine operator (used by the Krylov method)
+
+  // multigrid levels (level 0 is this processor's active block, with
+  // couplings to other processors lumped into the diagonal)
+  int NumberOfLevels;
+  int LevelDims[FLD_MG_MAX_LEVELS][3];
+  float *LevelA[FLD_MG_MAX_LEVELS];
+  float *LevelX[FLD_MG_MAX_LEVELS];
+  float *LevelB[FLD_MG_MAX_LEVELS];
+  float *LevelR[FLD_MG_MAX_LEVELS];
+
+  // Krylov vectors (one ghost layer in each active dimension)
+  EnzoVector *x, *r, *z, *p, *q, *rhat, *s, *y, *t;
+
+  int Matvec(EnzoVector *in, EnzoVector *out);
+  void MatvecLine(float *u, float *v, int j, int k, int ilo, int ihi);
+  int Precondition(EnzoVector *in, EnzoVector *out);
+  void Residual(int level);
+  void Smooth(int level, int sweeps, int reverse);
+  void VCycle(int level);
+
+ public:
+
+  // Constructor (allocates the hierarchy for a fixed local block)
+  FLDMultigrid(int Rank, int *LocDims, int NBors[3][2],
+	       int RelaxType, int PreRelax, int PostRelax);
+
+  // Destructor
+  ~FLDMultigrid();
+
+  // Load the stencil (HYPRE box ordering, StencilSize entries per
+  // cell) and rebuild the coarse operators
+  int Setup(Eflt64 *matentries, int StencilSize);
+
+  // Solve A*sol = rhs from a zero initial guess (Method 0 -> PCG,
+  // otherwise BiCGStab) to a relative residual of Tolerance
+  int Solve(Eflt64 *rhs, Eflt64 *sol, int Method, float Tolerance,
+	    int MaxIterations, float *FinalResidual, int *Iterations);
+
+};
+
+#endif
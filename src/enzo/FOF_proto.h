@@ -32,6 +32,7 @@ void   init_coarse_grid(FOFData &AllVars);
 int    link_across(FOFData &AllVars);
 void   linkit(int p, int s, FOFData &AllVars);
 void   link_local_slab(FOFData &AllVars);
+int    link_local_threaded(FOFData &AllVars);
 void   marking(FOFData &AllVars);
 int    number_of_unbound(FOFData &D, int head, int len);
 void   order_subgroups_by_potential(FOFData &D);
@@ -18,6 +18,10 @@
 /    flux data themselves: Left/RightFluxes).  The second dimension
 /    represents a vector that specifies the position of the first corner
 /    (StartGlobalIndex) or the end corner (EndGlobalIndex).
+/    Fluxes allocated with AllocateFluxes live in one block (FluxBuffer),
+/    ordered by dimension, then field, then left/right (the order in
+/    which they are communicated); otherwise FluxBuffer is NULL and each
+/    array is allocated separately.
 /
 /  REQUIRES: macros_and_parameters.h
 /
@@ -34,7 +38,10 @@ struct fluxes
   long_int RightFluxEndGlobalIndex[MAX_DIMENSION][MAX_DIMENSION];
   float *LeftFluxes[MAX_NUMBER_OF_BARYON_FIELDS][MAX_DIMENSION];
   float *RightFluxes[MAX_NUMBER_OF_BARYON_FIELDS][MAX_DIMENSION];
+  float *FluxBuffer;
+  int FluxBufferSize;
 };
 
 void InitializeFluxes(fluxes *Fluxes);
+void AllocateFluxes(fluxes *Fluxes, int NumberOfFields, int Rank);
 #endif
@@ -66,6 +66,7 @@ struct HierarchyEntry;
 extern int CommunicationDirection;
 int FindField(int f, int farray[], int n);
 struct LevelHierarchyEntry;
+struct InsituImage;
 class ActiveParticleType;
 class ActiveParticle_AccretingParticle;
 
@@ -100,6 +101,13 @@ class grid
   int    NumberOfBaryonFields;                        // active baryon fields
   float *BaryonField[MAX_NUMBER_OF_BARYON_FIELDS];    // pointers to arrays
   float *OldBaryonField[MAX_NUMBER_OF_BARYON_FIELDS]; // pointers to old arrays
+  float32 *ReducedOldBaryonField[MAX_NUMBER_OF_BARYON_FIELDS]; // 32-bit old arrays
+  float *DerivedField[NUMBER_OF_DERIVED_FIELDS];      // cached derived fields
+  FLOAT  DerivedFieldTime[NUMBER_OF_DERIVED_FIELDS];  // ... their grid time
+  int    DerivedFieldStamp[NUMBER_OF_DERIVED_FIELDS]; // ... the epoch
+  int    DerivedFieldVersionStamp[NUMBER_OF_DERIVED_FIELDS]; // ... and version
+  int    DerivedFieldVersion;  // advanced when this grid's fields change
+  float *SuperTimeStepField[3];  // RKL2 stage storage: Y0, L(Y0), Y(j-2)
   float *InterpolatedField[MAX_NUMBER_OF_BARYON_FIELDS]; // For RT and movies
   float *RandomForcingField[MAX_DIMENSION];           // pointers to arrays //AK
   int    FieldType[MAX_NUMBER_OF_BARYON_FIELDS];
@@ -180,6 +188,15 @@ class grid
   float* PhaseFctInitOdd;
   float* PhaseFctMultEven[MAX_DIMENSION];
   float* PhaseFctMultOdd[MAX_DIMENSION];
+  //
+  //  Phase factors exp(i*n*k*x) along each axis, for every wave number n
+  //  in the forcing band and every cell (n-major), and the last forcing
+  //  field computed on this grid with the spectrum stamp it belongs to
+  //
+  float* PhaseFctAxisEven[MAX_DIMENSION];
+  float* PhaseFctAxisOdd[MAX_DIMENSION];
+  float* ForcingFieldCache[MAX_DIMENSION];
+  int ForcingFieldStamp[MAX_DIMENSION];
 
 //
 //  Top grid parallelism (for implicit solvers)
@@ -444,6 +461,10 @@ public:
    int ConductHeat();			     /* Conduct Heat */
    float ComputeConductionTimeStep(float &dt); /* Estimate conduction time-step */
 
+/* RKL2 super-time-stepping stage for conduction or CR diffusion
+   (Operator = STSConduction or STSCRDiffusion) */
+   int DiffusionSuperTimeStepStage(int Operator, int Stage, int NumberOfStages);
+
 /* FDM: functions for lightboson dark matter */
   int ComputeQuantumTimeStep(float &dt); /* Estimate quantum time-step */
   /* Solver for Schrodinger Equation */ 
@@ -451,8 +472,9 @@ public:
 
 /* Member functions for dealing with Cosmic Ray Diffusion */
 
-  int ComputeAnisotropicCRDiffusion(); // Anisotropic CR Diffusion Method
+  int ComputeAnisotropicCRDiffusion(float *Rate = NULL); // Anisotropic CR Diffusion Method
   int ComputeCRDiffusion();            // Isotropic CR Diffusion Method 
+  int ComputeCRDiffusionRate(float *dCRdt); // Isotropic CR dE/dt only
   int ComputeCRDiffusionTimeStep(float &dt);
   int ComputeCRStreaming();            // Anisotropic CR Streaming Method
   int ComputeCRStreamingTimeStep(float &dt);
@@ -463,6 +485,11 @@ public:
    int CopyBaryonFieldToOldBaryonField();
    int CopyOldBaryonFieldToBaryonField();
 
+/* Baryons: convert any 32-bit old passive fields back to working
+    precision (see ReducedPrecisionPassiveFields). */
+
+   int ExpandReducedOldBaryonFields();
+
 
 /* Copy potential field to baryon potential for output purposes. */
 
@@ -623,6 +650,24 @@ gradient force to gravitational force for one-zone collapse test. */
 
    int ComputeCoolingTime(float *cooling_time, int CoolingTimeOnly=FALSE);
 
+/* Baryons: derived-field cache.  Read returns TRUE and copies the cached
+   field of the given type if it is still valid; Write stores it.  Get
+   returns a shared, read-only array holding the field (computing it if
+   required), which must be handed back with ReleaseDerivedField. */
+
+   int ReadDerivedFieldCache(int type, float *field);
+   void WriteDerivedFieldCache(int type, float *field);
+   float *GetDerivedField(int type);
+   void ReleaseDerivedField(float *field);
+   void DeleteDerivedFieldCache();
+
+/* Baryons: the fields of this grid have changed, so its cached derived
+   fields are no longer valid.  Ignored while the acceleration field is
+   attached in their place (SetAccelerationBoundary). */
+
+   void InvalidateDerivedFields() {
+     if (AccelerationHack != TRUE) DerivedFieldVersion++; };
+
 /* Baryons: compute cooling rate for user supplied data */
 
    int GrackleCustomCoolRate(int rank, int *dim, float *cool_rate,
@@ -695,6 +740,11 @@ gradient force to gravitational force for one-zone collapse test. */
 		       int NumberOfProjectedFields, int level,
 		       int MetalLinesUseLookupTable, char *MetalLinesFilename);
 
+/* Add the cells not covered by Subgrids to the in-situ projection image. */
+
+   int InsituProjectionDeposit(InsituImage &Image,
+			       LevelHierarchyEntry *Subgrids);
+
 /* Set the fields to zero under the active region of the specified subgrid. */
 
    int ZeroSolutionUnderSubgrid(grid *Subgrid, int FieldsToZero, 
@@ -1036,7 +1086,13 @@ gradient force to gravitational force for one-zone collapse test. */
             Returns SUCCESS or FAIL. */
 
    int InterpolateFieldValues(grid *ParentGrid , 
-			      LevelHierarchyEntry * OldFineLevel, TopGridData * MetaData);
+			      LevelHierarchyEntry * OldFineLevel, TopGridData * MetaData,
+			      int OnlyBoundary = FALSE);
+
+/* baryons: TRUE if InterpolateFieldValues can be limited to the ghost
+            zones (OnlyBoundary). */
+
+   int InterpolateFieldValuesOnlyBoundaryAvailable();
 
 
 /* Interpolate one radiation field.  Based on InterpolateFieldValues
@@ -1089,6 +1145,22 @@ gradient force to gravitational force for one-zone collapse test. */
   int CopyActiveZonesFromGrid(grid *GridOnSameLevel,
                   FLOAT EdgeOffset[MAX_DIMENSION], int SendField);
 
+/* baryons: with the old grids of this level that overlap this (new)
+            grid, return TRUE if they cover its whole active region, and
+            the old grid with the same extent, if it is on this processor
+            (RebuildHierarchy). */
+
+   int FindOldGridCoverage(grid **OldGrids, int NumberOfOldGrids,
+			   grid **IdenticalGrid);
+
+/* baryons: take over the field arrays of an identical old grid, instead
+            of copying them.  Both grids point to the arrays until the
+            old grid detaches them (RebuildHierarchy). */
+
+   int AdoptBaryonFields(grid *OldGrid);
+   int SharesBaryonFields(grid *OtherGrid);
+   void DetachBaryonFields();
+
 /* gravity: copy coincident potential field zones from grid in the argument
             (gg #7).  Return SUCCESS or FAIL. */
 
@@ -2564,9 +2636,10 @@ int zEulerSweep(int j, int NumberOfSubgrids, fluxes *SubgridFluxes[],
 
     void Phases(); // WS
 
-    /* Stochastic forcing: Compute physical force field via inverse FT of the forcing pectrum */
+    /* Stochastic forcing: Compute physical force field via inverse FT of the forcing pectrum
+       (KeepCopy: keep a copy to restore while the spectrum is unchanged) */
 
-    int FTStochasticForcing(int FieldDim); // WS
+    int FTStochasticForcing(int FieldDim, int KeepCopy = FALSE); // WS
 
 
     /* START Subgrid-scale modeling framework by P. Grete */
@@ -2899,7 +2972,7 @@ int zEulerSweep(int j, int NumberOfSubgrids, fluxes *SubgridFluxes[],
 
   int AddH2Dissociation(Star *AllStars, int NumberOfSources);
 
-  int AddH2DissociationFromTree(void);
+  int AddH2DissociationFromTree(int IncludeHMAndH2II);
   int AddH2DissociationFromSources(Star *AllStars);
 
   int ReturnStarStatistics(int &Number, float &minLife);
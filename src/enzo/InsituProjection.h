@@ -0,0 +1,69 @@
+/***********************************************************************
+/
+/  IN-SITU PROJECTIONS, SLICES AND PHASE HISTOGRAMS
+/
+/  written by: Enzo development team
+/  date:       October, 2026
+/  modified1:
+/
+/  PURPOSE:
+/    The image a processor accumulates for one in-situ snapshot (see
+/    InsituProjection.C and Grid_InsituProjectionDeposit.C).
+/
+************************************************************************/
+
+#ifndef INSITU_PROJECTION_DEFINED__
+#define INSITU_PROJECTION_DEFINED__
+
+#define INSITU_TILE_SIZE 64
+
+struct InsituImage {
+
+  int Axis;                          // line-of-sight axis
+  int Resolution;                    // pixels across the domain
+  int TilesPerSide;
+  int NumberOfFields;
+  int Field[MAX_INSITU_FIELDS];      // field types (or TEMPERATURE_FIELD)
+  int WeightField;                   // INT_UNDEFINED for no weighting
+  int Slice;                         // TRUE if slices are made
+  FLOAT SliceCoordinate;
+  int PhaseBins;                     // 0 for no phase histogram
+  float PhaseDensityRange[2];        // log10 g/cm^3
+  float PhaseTemperatureRange[2];    // log10 K
+  double DensityUnits, MassUnits;    // to g/cm^3 and Msun
+  char Label[MAX_INSITU_FIELDS][MAX_LINE_LENGTH];
+
+  /* Layers of each tile: the projections of field*weight (one per
+     field), the projection of the weight, then with slices the slice of
+     each field and the slice coverage.  A tile holds
+     INSITU_TILE_SIZE^2 pixels of every layer and is only allocated once
+     a grid on this processor touches it. */
+
+  int NumberOfLayers;
+  double **Tile;
+  double *Phase;
+};
+
+inline int InsituWeightLayer(InsituImage &Image)
+{ return Image.NumberOfFields; }
+
+inline int InsituSliceLayer(InsituImage &Image, int field)
+{ return Image.NumberOfFields + 1 + field; }
+
+inline int InsituCoverageLayer(InsituImage &Image)
+{ return 2*Image.NumberOfFields + 1; }
+
+/* Return the (zeroed on first use) tile with this index. */
+
+inline double *InsituImageTile(InsituImage &Image, int tile)
+{
+  if (Image.Tile[tile] == NULL) {
+    int size = Image.NumberOfLayers * INSITU_TILE_SIZE * INSITU_TILE_SIZE;
+    Image.Tile[tile] = new double[size];
+    for (int i = 0; i < size; i++)
+      Image.Tile[tile][i] = 0.0;
+  }
+  return Image.Tile[tile];
+}
+
+#endif
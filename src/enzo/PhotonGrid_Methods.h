@@ -72,6 +72,7 @@ void DeleteSubgridMarker() { delete [] SubgridMarker; SubgridMarker = NULL; };
 /* Initialize photoionization and heating fields  */
  
   int InitializeRadiativeTransferFields(void);
+  int FlagRayTracingOutputFields(int FieldFlag[]);
   int AllocateInterpolatedRadiation(void);
 
 /* Function that handle the dissociation/ionization effects of photons */
@@ -151,6 +152,12 @@ float LookUpCrossSectionH2II(float hnu, float T);
 
   int CommunicationSendSubgridMarker(grid *ToGrid, int ToProcessor);
 
+/* Replicate the ray tracing inputs of a grid on another processor, or
+   return the ray tracing results to the grid's own processor
+   (RadiativeTransferLoadBalance = 2) */
+
+  int CommunicationShareRayTracingGrid(int ToProcessor, int ReturnResults);
+
 /* Transport Photon Packages */ 
 
 int TransportPhotonPackages(int level, int finest_level,
@@ -527,6 +534,12 @@ int ReassignSuperSources(void);
 int CorrectRadiationIncompleteness(void);
 int FinalizeRadiationFields(void);
 
+/* Far-field ionizing and X-ray radiation from the source clustering
+   tree (RadiativeTransferFarFieldSources) */
+
+int FlagFarFieldRadiation(int UseTree);
+int AddFarFieldRadiationFromTree(void);
+
 //***********************************************************************
 // Routines for coupling to FLD solver
 
@@ -20,6 +20,17 @@ PhotonPackageEntry *PausedPhotonPackages;
 grid  **SubgridMarker; // pointers to first array elements of subgrids for each cell
 int HasRadiation;
 
+// Takes its ionizing and X-ray rates from the source clustering tree
+// (RadiativeTransferFarFieldSources)
+int FarFieldRadiation;
+// The optically-thin HI photo-ionization rate summed over the cells of
+// a far-field candidate, from the rays (accumulated while they cross
+// it) and from the tree (-1 if not a candidate), and the fraction of
+// the tree rate that the rays delivered in the previous photon step.
+float FarFieldRayRate;
+float FarFieldTreeRate;
+float FarFieldTransmission;
+
 // For adaptive timestep control while restricting the change in HII
 // to 50%, we need to record the minimum kph for which a ray passes
 // through with a cumulative optical depth >0.1.
@@ -18,8 +18,24 @@ struct SuperSourceEntry {
   FLOAT Position[MAX_DIMENSION];
   int LeafID;
   float ClusteringRadius;
+  // Distance from Position that encloses all of the sources in this
+  // branch.  Unlike ClusteringRadius, it is never shrunk to fit inside
+  // the parent.
+  float BoundingRadius;
+  float Luminosity;
   // Used for computing the Lyman-Werner radiation with the tree.
   float LWLuminosity;
+  // Same for H- detachment and H2+ dissociation, weighted by the
+  // cross-section [cm^2] of each energy bin.
+  float HMSigmaLuminosity;
+  float H2IISigmaLuminosity;
+  // Ionizing and X-ray luminosities for the far-field estimate
+  // (RadiativeTransferFarFieldSources), weighted by the HI, HeI and
+  // HeII cross-sections [cm^2].  See CreateSourceClusteringTree.
+  float IonSigmaLuminosity[3];
+  float IonHeatLuminosity[3];
+  float XRaySigmaLuminosity[3];
+  float ComptonLuminosity;
 };
 
 struct RadiationSourceEntry  {
@@ -51,6 +67,12 @@ struct SuperSourceData {
   FLOAT Position[MAX_DIMENSION];
   float Luminosity;
   float LWLuminosity;
+  float HMSigmaLuminosity;
+  float H2IISigmaLuminosity;
+  float IonSigmaLuminosity[3];
+  float IonHeatLuminosity[3];
+  float XRaySigmaLuminosity[3];
+  float ComptonLuminosity;
 };
 
 #endif
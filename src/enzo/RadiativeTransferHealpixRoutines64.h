@@ -149,6 +149,9 @@ void pix2vec_nest64(int64_t nside, int64_t ipix, double *vec);
 /*! Sets \a vec to the Cartesian vector pointing in the direction of the center
     of pixel \a ipix in RING scheme at resolution \a nside. */
 void pix2vec_ring64(int64_t nside, int64_t ipix, double *vec);
+/*! Same as pix2vec_nest64 at nside = 2^level, but looked up in a table
+    built on first use (up to a maximum level). */
+void pix2vec_nest64_level(long level, int64_t ipix, double *vec);
 
 /* FITS operations */
 /* --------------- */
@@ -59,6 +59,16 @@ EXTERN int RadiativeTransferSourceClustering;
 
 EXTERN int RadiativeTransferOpticallyThinSourceClustering;
 
+/* Take the ionizing and X-ray rates from the source clustering tree
+   in grids that are farther than FarFieldDistance grid widths from
+   every source, and whose own HI optical depth and that of the path
+   from the sources (measured by the rays) are below FarFieldMaxTau.
+   Rays cross these grids without being absorbed or split. */
+
+EXTERN int RadiativeTransferFarFieldSources;
+EXTERN float RadiativeTransferFarFieldMaxTau;
+EXTERN float RadiativeTransferFarFieldDistance;
+
 /* Radius to merge rays in units of separation of the two sources
    associated with a super source. */
 
@@ -51,6 +51,7 @@ class StochasticForcing {
     float *InjectionOdd[MAX_DIMENSION];  // random increments (sin modes)
     float *SpectrumEven[MAX_DIMENSION];  // forcing cos modes
     float *SpectrumOdd[MAX_DIMENSION];   // forcing sin modes
+    int SpectrumStamp;                   // incremented whenever the spectrum changes
 
  public:
 
@@ -108,6 +109,10 @@ class StochasticForcing {
     int get_NumModes(void);
     int get_NumNonZeroModes(void);
 //
+// Get the stamp of the current spectrum (changes with every update)
+//
+    int get_SpectrumStamp(void);
+//
 // Get spectral profile
 //
     forcing_type get_SpectProfile(void);
@@ -210,6 +215,11 @@ inline int StochasticForcing::get_NumNonZeroModes(void)
     return NumNonZeroModes;
 }
 
+inline int StochasticForcing::get_SpectrumStamp(void)
+{
+    return SpectrumStamp;
+}
+
 inline forcing_type StochasticForcing::get_SpectProfile(void)
 {
     return SpectProfile;
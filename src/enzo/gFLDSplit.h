@@ -41,6 +41,7 @@
 #include "EnzoVector.h"
 #include "InexactNewton.h"
 #include "ImplicitProblemABC.h"
+#include "FLDMultigrid.h"
 
 
 class gFLDSplit : public virtual ImplicitProblemABC {
@@ -74,6 +75,8 @@ class gFLDSplit : public virtual ImplicitProblemABC {
                                  //    0 => PCG
                                  //    1 => BiCGStab (default)
                                  //    2 => GMRES
+  int    sol_native;             // use the built-in multigrid solver
+                                 //   instead of HYPRE (always without HYPRE)
   Eint32 SolvIndices[3][2];      // L/R edge indices of subdomain in global mesh
                                  // Note: these INCLUDE Dirichlet zones, even 
                                  //   though those are not included as active 
@@ -91,6 +94,8 @@ class gFLDSplit : public virtual ImplicitProblemABC {
   Eflt64 *matentries;            // holds radiation matrix entries
   Eflt64 *rhsentries;            // linear system rhs entries
   Eflt64 *HYPREbuff;             // holds contiguous sections of rhs/sol
+  Eflt64 *nativesol;             // solution of the built-in solver
+  FLDMultigrid *MGsolver;        // built-in solver (kept across steps)
 
   // HYPRE solver diagnostics
   int totIters;                  // total MG iterations for solves
@@ -100,6 +100,7 @@ EXTERN int extract;
 EXTERN int CheckpointRestart;
 EXTERN int WriteGhostZones;
 EXTERN int ReadGhostZones;
+EXTERN int ReadGridFileCacheSize;
 EXTERN int ProblemType;
 #ifdef NEW_PROBLEM_TYPES
 EXTERN char *ProblemTypeName;
@@ -210,6 +211,25 @@ EXTERN float CoolingTimestepSafetyFactor;
 EXTERN interpolation_type InterpolationMethod;
 EXTERN int ConservativeInterpolation;
 
+/* Hold the old-time copy of passive scalars in 32 bits, and pack that
+   copy as 32-bit values in grid communication (0 - off, 1 - colours and
+   metals, 2 - also the chemical species).  Current-time fields keep full
+   precision.  Only has an effect for 64-bit fields. */
+
+EXTERN int ReducedPrecisionPassiveFields;
+
+/* Keep the pressure and temperature of each grid after they are
+   computed and reuse them until the baryon fields change.
+   DerivedFieldEpoch is advanced whenever the fields of grids on any level
+   may have changed; changes to a single grid advance its own version
+   (grid::InvalidateDerivedFields).  DerivedFieldCacheActive is only set
+   once the hierarchy evolves, since the initializers change the fields
+   without invalidating them. */
+
+EXTERN int DerivedFieldCache;
+EXTERN int DerivedFieldCacheActive;
+EXTERN int DerivedFieldEpoch;
+
 /* This is the minimum efficiency of combined grid needs to achieve in
    order to be considered better than the two grids from which it formed. */
 
@@ -364,6 +384,12 @@ EXTERN float ParticleCourantSafetyNumber;
 
 EXTERN float dtMinimumRegularizer;
 
+/* If set, the timestep of a level with no finer grids is reduced over
+   processors with a non-blocking collective that overlaps the hierarchy
+   rebuild (see SetLevelTimeStep). */
+
+EXTERN int TimeStepEarlyReduction;
+
 /* This is a parameter to control root grid time steps, and is basically
    a hack to ensure that star particles don't get ejected out of grids. */
 
@@ -597,6 +623,11 @@ EXTERN int NumberOfRootGridTilesPerDimensionPerProcessor;
 EXTERN int CosmologySimulationNumberOfInitialGrids;
 EXTERN int UserDefinedRootGridLayout[3];
 
+/* Keep large read-only tables (Cloudy cooling, equilibrium tables) once
+   per node in MPI-3 shared memory instead of once per processor. */
+
+EXTERN int SharedMemoryTables;
+
 /* Parameters that control density dex output */
 
 EXTERN int OutputOnDensity;
@@ -613,6 +644,8 @@ EXTERN float EnrichedMetalFraction;
 EXTERN int PythonTopGridSkip;
 EXTERN int PythonSubcycleSkip;
 EXTERN int PythonReloadScript;
+EXTERN int PythonAsynchronous;
+EXTERN int PythonMaximumAnalysisProcesses;
 
 /* Parameters to control inline halo finding */
 
@@ -847,6 +880,20 @@ EXTERN float *StarParticlesOnProcOnLvl_Attr[128][MAX_NUMBER_OF_PARTICLE_ATTRIBUT
 EXTERN int *StarParticlesOnProcOnLvl_Type[128];
 EXTERN PINT *StarParticlesOnProcOnLvl_Number[128];
 
+/* In-situ projections, slices and phase histograms (InsituProjection.C) */
+
+EXTERN FLOAT InsituProjectionDt;
+EXTERN FLOAT InsituProjectionTimeLast;
+EXTERN int InsituProjectionNumber;
+EXTERN int InsituProjectionAxis;
+EXTERN int InsituProjectionResolution;
+EXTERN int InsituProjectionField[MAX_INSITU_FIELDS];
+EXTERN int InsituProjectionWeightField;
+EXTERN FLOAT InsituSliceCoordinate;
+EXTERN int InsituPhaseBins;
+EXTERN float InsituPhaseDensityRange[2];
+EXTERN float InsituPhaseTemperatureRange[2];
+
 /* Stanford Hydro Solver variables */
 
 /* Hydro parameters */
@@ -1131,6 +1178,13 @@ EXTERN float AnisotropicConductionSpitzerFraction;  // f_Spitzer
 EXTERN float ConductionCourantSafetyNumber;
 EXTERN int SpeedOfLightTimeStepLimit; // TRUE OR FALSE
 
+/* RKL2 super-time-stepping of thermal conduction and CR diffusion
+   (0 - subcycle, 1 - RKL2), and the number of stages that sets how far
+   the hydro timestep may exceed the explicit diffusion step. */
+
+EXTERN int DiffusionSuperTimeStepping;
+EXTERN int DiffusionSuperTimeSteppingMaxStages;
+
 /* SMBH Feedback in galaxy clusters*/
 EXTERN int ClusterSMBHFeedback;  // TRUE OR FALSE
 EXTERN float ClusterSMBHJetMdot;  // JetMdot in SolarMass/yr 
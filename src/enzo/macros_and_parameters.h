@@ -49,6 +49,8 @@
 
 #define MAX_NUMBER_OF_BARYON_FIELDS          __max_baryons  /* must be at least 6 */
 
+#define NUMBER_OF_DERIVED_FIELDS             4
+
 #define MAX_NUMBER_OF_SUBGRIDS               __max_subgrids
 
 #define MAX_DEPTH_OF_HIERARCHY             50
@@ -94,6 +96,8 @@
 
 #define MAX_MOVIE_FIELDS                    6
 
+#define MAX_INSITU_FIELDS                   6
+
 #define MAX_POTENTIAL_ITERATIONS            80
 
 #define MAX_ENERGY_BINS                    10
@@ -410,6 +414,8 @@ typedef long long int   HDF5_hid_t;
 //If MAX_EXTRA_OUTPUTS neesd to be changed, change statements in ReadParameterFile and WriteParameterFile.
 #define MAX_EXTRA_OUTPUTS                10 
 
+#define RAY_TRACING_OUTPUT_FIELDS        -15
+#define RAY_TRACING_INPUT_FIELDS         -14
 #define BARYONS_ELECTRIC                 -13
 #define BARYONS_MAGNETIC                 -12
 #define JUST_BARYONS                     -11
@@ -195,6 +195,8 @@ enum field_type {Density, TotalEnergy, InternalEnergy, Pressure,
 
 #define FieldTypeIsDensity(A) ((((A) >= TotalEnergy && (A) <= Velocity3) || ((A) >= kphHI && (A) <= kdissH2I) || ((A) == kdissH2II) || ((A) == kphHM) || ((A) >= RadiationFreq0 && (A) <= RaySegments) || ((A) >= Bfield1 && (A) <= AccelerationField3)) ? FALSE : TRUE)
 #define FieldTypeIsRadiation(A) ((((A) >= kphHI && (A) <= kdissH2I) || ((A) == kdissH2II) || ((A) == kphHM) || ((A) >= RadiationFreq0 && (A) <= RadiationFreq9)) ? TRUE : FALSE)
+#define FieldTypeIsSpecies(A) ((((A) >= ElectronDensity && (A) <= HDIDensity) || ((A) >= CIDensity && (A) <= O2IDensity)) ? TRUE : FALSE)
+#define FieldTypeIsColour(A) ((((A) >= SNColour && (A) <= ExtraType1) || ((A) == Galaxy1Colour) || ((A) == Galaxy2Colour) || ((A) == MBHColour) || ((A) == MetalSNIaDensity) || ((A) == MetalSNIIDensity)) ? TRUE : FALSE)
 #define FieldTypeNoInterpolate(A) (((((A) >= Mach) && ((A) <= PreShockDensity)) || ((A) == GravPotential) || ((A) == RaySegments)) ? TRUE : FALSE)
 
 /* Different stochastic forcing types */
@@ -281,6 +283,19 @@ const enum_type FluxReconstruction = 0, HLL = 1, Marquina = 2,
 const enum_type Neumann = 0, Dirichlet = 1;
 const enum_type Isotropic = 1, Beamed = -2, Episodic = -3;
 
+/* Derived fields returned by grid::GetDerivedField.  The first
+   NUMBER_OF_DERIVED_FIELDS are held in the per-grid cache (see
+   Grid_DerivedFieldCache.C); the cooling times are always recomputed. */
+
+const enum_type DerivedPressure = 0, DerivedPressureCR = 1,
+  DerivedTemperature = 2, DerivedTemperatureCR = 3,
+  DerivedCoolingTime = 4, DerivedCoolingTimeOnly = 5;
+
+/* Operators advanced by diffusion super-time-stepping (see
+   DiffusionSuperTimeStep.C). */
+
+const enum_type STSConduction = 0, STSCRDiffusion = 1;
+
 /* Stanford RK MUSCL solvers support */ 
 //enum {Cartesian, Spherical, Cylindrical};
 //enum {PLM, PPM, CENO, WENO3, WENO5};